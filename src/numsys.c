@@ -2,6 +2,7 @@
 #include <errno.h>
 #include <limits.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -25,6 +26,13 @@
         (digit) + 10 - 'a' :    /* Uppercase */ \
         (digit) + 10 - 'A'))    /* Lowercase */ \
 
+/* Takes:   char, unsigned
+ * Returns: bool
+ *
+ * Returns true if char is not a digit of given base
+ * Causes side-effects */
+#define inval_digit(digit, base)    (!isalnum(digit) || (unsigned) digit_to_num(digit) >= (base))
+
 /* Takes:   unsigned
  * Returns: bool
  *
@@ -62,6 +70,13 @@
  * Causes side-effects */
 #define max_digit(base)     ((base) <= 10 ? (base) + '0' - 1 : (base) + 'A' - 11)
 
+/* Takes:   unsigned
+ * Returns: char
+ *
+ * Returns char digit equivalent of int
+ * Causes side-effects */
+#define num_to_digit(num)   ((num) + ((num) < 10 ? '0' : 'A' - 10))
+
 /* Takes:   unsigned
  * Returns: unsigned
  *
@@ -145,6 +160,149 @@ static char *valid_chrs(numsys_t sys) {
     return valid;
 }
 
+/* Returns number of digits in equivalent number string of 32-bit value
+ * Unlike ndigits(), avoids 64-bit division */
+static unsigned ndigits32(uint32_t num, unsigned base) {
+    unsigned count = 0;
+
+    if (base == 1)
+        return num;
+    do {
+        num /= base;
+        ++count;
+    } while (num);
+    return count;
+}
+
+/* Returns malloc'd number string of 32-bit magnitude according to given system
+ * Pads sign place and complement representations to at least 'pad' digits
+ * Returns NULL on error */
+static char *tostr32(uint32_t mag, bool is_signed, numsys_t sys, numinfo_t info, unsigned pad) {
+    const bool has_sign_place = sys.base != 1 && (sys.rep != NR_NEGSGN || is_signed);
+    const bool is_compl = is_signed && sys.base != 1 && sys.rep & (NR_1COMPL|NR_2COMPL);
+
+    if (is_compl && sys.rep == NR_2COMPL)
+        --mag;  // Complement of magnitude minus 1
+
+    unsigned nchrs = ndigits32(mag, sys.base);
+    const size_t total = max(max(info.min, nchrs), pad);    // Total # of digits
+    const size_t memsize = total + nspaces(total, info.space) + has_sign_place + 1;
+    char *const result = coll_queue(malloc(memsize * sizeof(char)));
+
+    if (!result)   // malloc() fails
+        return NULL;
+
+    const char max = max_digit(sys.base);
+    unsigned digit_val;
+
+    result[memsize - 1] = '\0';
+    for (size_t i = memsize - 1, place = 0; i > has_sign_place; ++place) {
+        if (place && info.space && !(place % info.space))
+            result[--i] = ' ';
+        if (nchrs) {
+            digit_val = mag % sys.base;
+            mag /= sys.base;
+            if (is_compl)
+                digit_val = sys.base - digit_val - 1;   // Get complement
+            result[--i] = num_to_digit(digit_val);
+            --nchrs;
+        } else
+            result[--i] = is_compl ? max : '0';
+    }
+    if (has_sign_place) {
+        if (is_signed)
+            result[0] = sys.rep == NR_NEGSGN ? '-' : max;
+        else
+            result[0] = '0';
+    }
+    return result;
+}
+
+/* Returns malloc'd number string of value within 'width' bits according to given system
+ * Returns NULL and sets errno accordingly on error */
+static char *tostr_width(int32_t num, numsys_t sys, numinfo_t info, unsigned width) {
+    if (inval_base(sys.base) || inval_rep(sys.rep) || inval_info(info, sys.base))
+        error(EINVAL, NULL);
+
+    const bool is_signed = num < 0;
+    const uint32_t mag = is_signed ? -(uint32_t)num : (uint32_t)num;
+    const unsigned pad = sys.rep != NR_NEGSGN && sys.base != 1 ?    // Natural width
+      ndigits32(((uint32_t)1 << (width - 1)) - 1, sys.base) : 0;
+
+    return tostr32(mag, is_signed, sys, info, pad);
+}
+
+/* Returns value of number string within 'width' bits according to given system
+ * Returns 0 and sets errno accordingly on error */
+static int32_t tonum_width(const char *numstr, numsys_t sys, unsigned width) {
+    if (!numstr || inval_base(sys.base) || inval_rep(sys.rep))
+        error(EINVAL, 0);
+
+    const size_t sign_index = strspn(numstr, IGNORE);
+    const bool has_sign_place = sys.rep != NR_NEGSGN && sys.base != 1;
+    const bool has_neg_sign = sys.rep == NR_NEGSGN && numstr[sign_index] == '-';
+
+    if (has_sign_place && inval_digit(numstr[sign_index], sys.base))
+        error(EINVAL, 0);   // Missing sign place
+
+    const bool is_signed = has_neg_sign || (has_sign_place && numstr[sign_index] != '0');
+    const bool is_compl = is_signed && sys.rep & (NR_1COMPL|NR_2COMPL);
+    const bool add_one = is_compl && sys.rep == NR_2COMPL;
+    const uint32_t limit =  // Maximum magnitude, less 1 for two's complement
+      ((uint32_t)1 << (width - 1)) - !is_signed - add_one;
+    const char *cur = numstr + sign_index + (has_sign_place || has_neg_sign);
+    unsigned digit_val;
+    uint32_t result = 0;
+    bool has_digits = false;
+
+    for (; *cur; ++cur) {
+        if (strchr(IGNORE, *cur))
+            continue;
+        if (inval_digit(*cur, sys.base))
+            error(EINVAL, 0);
+        digit_val = sys.base == 1 ? 1 : digit_to_num(*cur);
+        if (is_compl)
+            digit_val = sys.base - digit_val - 1;
+        if (result > (limit - digit_val) / sys.base)
+            error(EOVERFLOW, 0);
+        result = result * sys.base + digit_val;
+        has_digits = true;
+    }
+    if (!has_digits && !has_sign_place && sys.base != 1)    // Base-1 zero has no digits
+        error(EINVAL, 0);
+    result += add_one;
+    if (!is_signed || !result)
+        return result;
+    return -(int32_t)(result - 1) - 1;  // Avoids overflow of minimum value
+}
+
+/* Returns value of unsigned number string within 'width' bits according to given base
+ * Returns 0 and sets errno accordingly on error */
+static uint32_t utonum_width(const char *numstr, unsigned base, unsigned width) {
+    if (!numstr || inval_base(base))
+        error(EINVAL, 0);
+
+    const uint32_t limit = width < 32 ? ((uint32_t)1 << width) - 1 : UINT32_MAX;
+    unsigned digit_val;
+    uint32_t result = 0;
+    bool has_digits = false;
+
+    for (const char *cur = numstr; *cur; ++cur) {
+        if (strchr(IGNORE, *cur))
+            continue;
+        if (inval_digit(*cur, base))
+            error(EINVAL, 0);
+        digit_val = base == 1 ? 1 : digit_to_num(*cur);
+        if (result > (limit - digit_val) / base)
+            error(EOVERFLOW, 0);
+        result = result * base + digit_val;
+        has_digits = true;
+    }
+    if (!has_digits && base != 1)
+        error(EINVAL, 0);
+    return result;
+}
+
 // ---- Non-Static Functions ----
 
 char *nsys_conv(const char *numstr, numsys_t src, numsys_t dest, numinfo_t info) {
@@ -154,6 +312,84 @@ char *nsys_conv(const char *numstr, numsys_t src, numsys_t dest, numinfo_t info)
         return NULL;
     return nsys_tostr(tmp, dest, info);
 }
+char *nsys_repconv(const char *numstr, unsigned base, numrep_t src, numrep_t dest,
+  char *buf, size_t size) {
+    if (!numstr || !buf || base < 2 || inval_base(base) || inval_rep(src) || inval_rep(dest))
+        error(EINVAL, NULL);
+
+    const size_t sign_index = strspn(numstr, IGNORE);
+    const char max = max_digit(base);
+    const bool is_signed = src == NR_NEGSGN ?
+      numstr[sign_index] == '-' : numstr[sign_index] != '0';
+
+    if (src != NR_NEGSGN && inval_digit(numstr[sign_index], base))
+        error(EINVAL, NULL);    // Missing sign place
+
+    const size_t digits_index = sign_index + (src != NR_NEGSGN || is_signed);
+    size_t len, count = 0, nzeros = 0, nmaxes = 0;
+    char cur;
+
+    for (len = 0; (cur = numstr[digits_index + len]); ++len) {
+        if (strchr(IGNORE, cur))
+            continue;
+        if (inval_digit(cur, base))
+            error(EINVAL, NULL);
+        ++count;
+        nzeros += cur == '0';
+        nmaxes += toupper(cur) == max;
+    }
+    if (src == NR_NEGSGN && !count)
+        error(EINVAL, NULL);
+
+    /* Digits of negatives hold either the magnitude, its complement, or its complement
+     * plus 1, so any change between them is a complement followed by a step of +/-1 */
+    const bool src_compl = src & (NR_1COMPL|NR_2COMPL);
+    const bool dest_compl = dest & (NR_1COMPL|NR_2COMPL);
+    const bool complement = is_signed && src_compl != dest_compl;
+    const int step = !is_signed || src == dest ? 0 :
+      dest == NR_2COMPL || (src == NR_2COMPL && !dest_compl) ? 1 :
+      src == NR_2COMPL && dest == NR_1COMPL ? -1 : 0;
+    const bool overflow = step > 0 ?    // Carry or borrow passes leading digit
+      (complement ? nzeros : nmaxes) == count : step < 0 && nzeros == count;
+    const bool out_signed = is_signed &&    // Negative zero becomes zero
+      !(overflow && dest == NR_2COMPL) && (count || src == NR_2COMPL);
+    const bool extra = overflow && out_signed;  // Leading digit added
+    const size_t sign_len = dest == NR_NEGSGN ? out_signed || !count : 1;
+    const size_t offset = sign_len + extra;
+
+    if (offset + len + 1 > size)
+        error(ERANGE, NULL);
+    memmove(buf + offset, numstr + digits_index, len + 1);
+
+    bool carry = step != 0;
+    unsigned digit_val;
+
+    for (size_t i = offset + len; i-- > offset;) {
+        cur = buf[i];
+        if (strchr(IGNORE, cur))
+            continue;
+        if (!complement && !carry)
+            break;
+        digit_val = digit_to_num(cur);
+        if (complement)
+            digit_val = base - digit_val - 1;
+        if (carry && step > 0) {
+            carry = digit_val == base - 1;
+            digit_val = carry ? 0 : digit_val + 1;
+        } else if (carry) {
+            carry = !digit_val;
+            digit_val = carry ? base - 1 : digit_val - 1;
+        }
+        buf[i] = num_to_digit(digit_val);
+    }
+    if (dest != NR_NEGSGN)
+        buf[0] = out_signed ? max : '0';
+    else if (sign_len)
+        buf[0] = out_signed ? '-' : '0';
+    if (extra)
+        buf[sign_len] = step > 0 ? '1' : num_to_digit(base - 2);
+    return buf;
+}
 long long nsys_tonum(const char *numstr, numsys_t sys) {
     coll_einit(0, long long, nsys_tonum, numstr, sys);
 
@@ -333,3 +569,46 @@ char *nsys_utostr(unsigned long long num, unsigned base, numinfo_t info) {
     }
     return result;
 }
+
+int8_t nsys_tonum8(const char *numstr, numsys_t sys) {
+    return tonum_width(numstr, sys, 8);
+}
+int16_t nsys_tonum16(const char *numstr, numsys_t sys) {
+    return tonum_width(numstr, sys, 16);
+}
+int32_t nsys_tonum32(const char *numstr, numsys_t sys) {
+    return tonum_width(numstr, sys, 32);
+}
+uint8_t nsys_utonum8(const char *numstr, unsigned base) {
+    return utonum_width(numstr, base, 8);
+}
+uint16_t nsys_utonum16(const char *numstr, unsigned base) {
+    return utonum_width(numstr, base, 16);
+}
+uint32_t nsys_utonum32(const char *numstr, unsigned base) {
+    return utonum_width(numstr, base, 32);
+}
+char *nsys_tostr8(int8_t num, numsys_t sys, numinfo_t info) {
+    return tostr_width(num, sys, info, 8);
+}
+char *nsys_tostr16(int16_t num, numsys_t sys, numinfo_t info) {
+    return tostr_width(num, sys, info, 16);
+}
+char *nsys_tostr32(int32_t num, numsys_t sys, numinfo_t info) {
+    return tostr_width(num, sys, info, 32);
+}
+char *nsys_utostr8(uint8_t num, unsigned base, numinfo_t info) {
+    if (inval_base(base) || inval_info(info, base))
+        error(EINVAL, NULL);
+    return tostr32(num, false, (numsys_t) {base, NR_NEGSGN}, info, 0);
+}
+char *nsys_utostr16(uint16_t num, unsigned base, numinfo_t info) {
+    if (inval_base(base) || inval_info(info, base))
+        error(EINVAL, NULL);
+    return tostr32(num, false, (numsys_t) {base, NR_NEGSGN}, info, 0);
+}
+char *nsys_utostr32(uint32_t num, unsigned base, numinfo_t info) {
+    if (inval_base(base) || inval_info(info, base))
+        error(EINVAL, NULL);
+    return tostr32(num, false, (numsys_t) {base, NR_NEGSGN}, info, 0);
+}
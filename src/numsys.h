@@ -1,6 +1,9 @@
 #ifndef LADLE_NUMSYS_H
 #define LADLE_NUMSYS_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <ladle/common/header.h>
 
 // Information pertaining to a number's string representation
@@ -38,6 +41,20 @@ BEGIN
 export char *nsys_conv(const char *numstr, numsys_t src, numsys_t dest, numinfo_t info) nonnull noexcept;
 export char *nsys_uconv(const char *numstr, unsigned src, unsigned dest, numinfo_t info) nonnull noexcept;
 
+/* Rewrites number string of representation 'src' as equivalent string of representation 'dest'
+ * Writes result to 'buf' of 'size' chars, which may be the same buffer as 'numstr'
+ * Returns 'buf' on success
+ * Returns NULL and sets errno accordingly on error
+ * Runs in linear time without allocation, so number strings may be of any length
+ * Digits and spaces following the sign are kept in place; one leading digit is
+ * added when a carry or borrow passes the most significant digit
+ *
+ * Error Code    Cause
+ *  EINVAL        Null string or an invalid system base or notation
+ *  ERANGE        Result cannot fit within 'size' chars */
+export char *nsys_repconv(const char *numstr, unsigned base, numrep_t src, numrep_t dest,
+  char *buf, size_t size) nonnull noexcept;
+
 /* Returns value of number string according to given number system
  * Returns 0 and sets errno accordingly on error
  *
@@ -59,7 +76,111 @@ export unsigned long long nsys_utonum(const char *numstr, unsigned base) nonnull
 export char *nsys_tostr(long long num, numsys_t sys, numinfo_t info) noexcept;
 export char *nsys_utostr(unsigned long long num, unsigned base, numinfo_t info) noexcept;
 
+/* Returns value of number string according to given system within 8, 16, or 32 bits
+ * Returns 0 and sets errno accordingly on error
+ *
+ * Error Code    Cause
+ *  EINVAL        Null string or an invalid system base or notation
+ *  EOVERFLOW     Value cannot be represented in the integer width
+ *  (else)        Internal error */
+export int8_t nsys_tonum8(const char *numstr, numsys_t sys) nonnull noexcept;
+export int16_t nsys_tonum16(const char *numstr, numsys_t sys) nonnull noexcept;
+export int32_t nsys_tonum32(const char *numstr, numsys_t sys) nonnull noexcept;
+export uint8_t nsys_utonum8(const char *numstr, unsigned base) nonnull noexcept;
+export uint16_t nsys_utonum16(const char *numstr, unsigned base) nonnull noexcept;
+export uint32_t nsys_utonum32(const char *numstr, unsigned base) nonnull noexcept;
+
+/* Returns malloc'd number string of 8, 16, or 32-bit value according to given system
+ * Returns NULL and sets errno accordingly on error
+ * Sign place and complement representations are padded to the width of the integer,
+ * e.g. 8 digits for base-2 int8_t
+ * Base-1 negatives will hold the value of their absolute value
+ *
+ * Error Code    Cause
+ *  EINVAL        Invalid system base or notation
+ *  (else)        Internal error */
+export char *nsys_tostr8(int8_t num, numsys_t sys, numinfo_t info) noexcept;
+export char *nsys_tostr16(int16_t num, numsys_t sys, numinfo_t info) noexcept;
+export char *nsys_tostr32(int32_t num, numsys_t sys, numinfo_t info) noexcept;
+export char *nsys_utostr8(uint8_t num, unsigned base, numinfo_t info) noexcept;
+export char *nsys_utostr16(uint16_t num, unsigned base, numinfo_t info) noexcept;
+export char *nsys_utostr32(uint32_t num, unsigned base, numinfo_t info) noexcept;
+
 END
 
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__cplusplus)
+
+#include <limits.h>
+
+// Conversions of char, chosen by its signedness
+#if CHAR_MIN < 0
+#define NSYS_TONUM_CHAR     nsys_tonum8
+#define NSYS_TOSTR_CHAR     nsys_tostr8
+#else
+#define NSYS_TONUM_CHAR     nsys_utonum8
+#define NSYS_TOSTR_CHAR     nsys_utostr8
+#endif
+
+// Conversions of long and unsigned long, chosen by their width
+#if LONG_MAX == INT32_MAX
+#define NSYS_TONUM_LONG     nsys_tonum32
+#define NSYS_TOSTR_LONG     nsys_tostr32
+#else
+#define NSYS_TONUM_LONG     nsys_tonum
+#define NSYS_TOSTR_LONG     nsys_tostr
+#endif
+#if ULONG_MAX == UINT32_MAX
+#define NSYS_UTONUM_LONG    nsys_utonum32
+#define NSYS_UTOSTR_LONG    nsys_utostr32
+#else
+#define NSYS_UTONUM_LONG    nsys_utonum
+#define NSYS_UTOSTR_LONG    nsys_utostr
+#endif
+
+/* Takes:   const char *, numsys_t or unsigned, T *; where T is an integral type
+ * Returns: T
+ *
+ * Stores value of number string in integer pointed to by 'dest'
+ * Selects the narrowest conversion able to hold T
+ * Signed types take a numsys_t, while unsigned types take a base
+ * Plain char is signed or unsigned as defined by the implementation
+ * Causes side-effects */
+#define nsys_gtonum(numstr, sys, dest)                  \
+    (*(dest) = _Generic(*(dest),                        \
+      char:                 NSYS_TONUM_CHAR,            \
+      signed char:          nsys_tonum8,                \
+      unsigned char:        nsys_utonum8,               \
+      short:                nsys_tonum16,               \
+      unsigned short:       nsys_utonum16,              \
+      int:                  nsys_tonum32,               \
+      unsigned:             nsys_utonum32,              \
+      long:                 NSYS_TONUM_LONG,            \
+      unsigned long:        NSYS_UTONUM_LONG,           \
+      long long:            nsys_tonum,                 \
+      unsigned long long:   nsys_utonum)((numstr), (sys)))
+
+/* Takes:   T, numsys_t or unsigned, numinfo_t; where T is an integral type
+ * Returns: char *
+ *
+ * Returns malloc'd number string of value according to given system
+ * Selects the narrowest conversion able to hold T
+ * Signed types take a numsys_t, while unsigned types take a base
+ * Plain char is signed or unsigned as defined by the implementation */
+#define nsys_gtostr(num, sys, info)                     \
+    _Generic((num),                                     \
+      char:                 NSYS_TOSTR_CHAR,            \
+      signed char:          nsys_tostr8,                \
+      unsigned char:        nsys_utostr8,               \
+      short:                nsys_tostr16,               \
+      unsigned short:       nsys_utostr16,              \
+      int:                  nsys_tostr32,               \
+      unsigned:             nsys_utostr32,              \
+      long:                 NSYS_TOSTR_LONG,            \
+      unsigned long:        NSYS_UTOSTR_LONG,           \
+      long long:            nsys_tostr,                 \
+      unsigned long long:   nsys_utostr)((num), (sys), (info))
+
+#endif  // C11 or later
+
 #include <ladle/common/end_header.h>
 #endif  // #ifndef LADLE_NUMSYS_H
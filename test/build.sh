@@ -1,3 +1,5 @@
 gcc -g -o conv conv.c ../src/numsys.c -lm
 gcc -g -o tonum tonum.c ../src/numsys.c -lm
 gcc -g -o tostring tostring.c ../src/numsys.c -lm
+gcc -g -o repconv repconv.c ../src/numsys.c -lm
+gcc -g -std=c11 -o width width.c ../src/numsys.c -lm
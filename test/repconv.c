@@ -0,0 +1,63 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "debug.h"
+#include "../src/numsys.h"
+
+#define loop(body)    for (int i = 2; i < 37; ++i) body
+
+#define repconv_print(_base, _src_rep, _dest_rep, _call) {                      \
+errno = 0;                                                                      \
+const char *const _result = _call;                                              \
+printf("base = %i\n"                                                            \
+       "src representation = %d\n"                                             \
+       "dest representation = %d\n"                                            \
+       "result = %s\n"                                                          \
+       "errno = %d\n\n",                                                        \
+    _base, _src_rep, _dest_rep, _result, errno);                                \
+}
+
+// Converts into separate buffer
+#define repconv_test(_base, _src_rep, _dest_rep)                                \
+    repconv_print(_base, _src_rep, _dest_rep,                                   \
+      nsys_repconv(argv[1], _base, _src_rep, _dest_rep, buf, sizeof buf))
+
+// Converts within buffer holding input, which has room for a carried digit
+#define inplace_test(_base, _src_rep, _dest_rep)                                \
+    repconv_print(_base, _src_rep, _dest_rep,                                   \
+      nsys_repconv(strcpy(buf, argv[1]), _base, _src_rep, _dest_rep, buf, sizeof buf))
+
+// Converts into buffer one char short of result, expecting ERANGE
+#define erange_test(_base, _src_rep, _dest_rep)                                 \
+    repconv_print(_base, _src_rep, _dest_rep,                                   \
+      (nsys_repconv(argv[1], _base, _src_rep, _dest_rep, buf, sizeof buf) ?     \
+        nsys_repconv(argv[1], _base, _src_rep, _dest_rep, buf, strlen(buf)) :   \
+        NULL))
+
+int main(int argc, char *argv[]) {
+    char buf[256];
+
+    query();
+    loop(repconv_test(i, NR_2COMPL, NR_NEGSGN));
+    loop(repconv_test(i, NR_2COMPL, NR_SPLACE));
+    query();
+    loop(repconv_test(i, NR_2COMPL, NR_1COMPL));
+    loop(repconv_test(i, NR_1COMPL, NR_2COMPL));
+    query();
+    loop(repconv_test(i, NR_NEGSGN, NR_2COMPL));
+    loop(repconv_test(i, NR_SPLACE, NR_1COMPL));
+    query();
+    loop(inplace_test(i, NR_2COMPL, NR_SPLACE));
+    loop(inplace_test(i, NR_NEGSGN, NR_1COMPL));
+    query();
+    loop(erange_test(i, NR_2COMPL, NR_SPLACE));
+    loop(erange_test(i, NR_NEGSGN, NR_1COMPL));
+    query();
+
+    // Rewrites argument in place, failing with ERANGE if a digit must be added
+    repconv_print(2, NR_2COMPL, NR_1COMPL,
+      nsys_repconv(argv[1], 2, NR_2COMPL, NR_1COMPL, argv[1], strlen(argv[1]) + 1));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,46 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "debug.h"
+#include "../src/numsys.h"
+
+#define loop(body)    for (int i = 1; i < 37; ++i) body
+
+// Reads input as 'src', then prints it as 'dest'
+#define width_test(_type, _fmt, _src, _dest) {                                  \
+_type num;                                                                      \
+errno = 0; nsys_gtonum(argv[1], _src, &num);                                    \
+printf("type = " #_type "\n"                                                    \
+       "base = %i\n"                                                            \
+       "errno = %d\n"                                                           \
+       "result = " _fmt "\n"                                                    \
+       "string = %s\n\n",                                                       \
+    i, errno, num, nsys_gtostr(num, _dest, (numinfo_t) {0}));                   \
+}
+
+// Reads signed input with negative sign, then prints it in 'rep'
+#define signed_test(_type, _fmt, _rep)                                          \
+    width_test(_type, _fmt, ((numsys_t) {i, NR_NEGSGN}), ((numsys_t) {i, _rep}))
+
+int main(int argc, char *argv[]) {
+    query();
+    loop(signed_test(signed char, "%hhd", NR_NEGSGN));
+    loop(signed_test(signed char, "%hhd", NR_SPLACE));
+    query();
+    loop(signed_test(signed char, "%hhd", NR_2COMPL));
+    loop(width_test(unsigned char, "%hhu", i, i));
+    query();
+    loop(signed_test(short, "%hd", NR_NEGSGN));
+    loop(signed_test(short, "%hd", NR_SPLACE));
+    query();
+    loop(signed_test(short, "%hd", NR_2COMPL));
+    loop(width_test(unsigned short, "%hu", i, i));
+    query();
+    loop(signed_test(int, "%d", NR_NEGSGN));
+    loop(signed_test(int, "%d", NR_SPLACE));
+    query();
+    loop(signed_test(int, "%d", NR_2COMPL));
+    loop(width_test(unsigned, "%u", i, i));
+    return EXIT_SUCCESS;
+}